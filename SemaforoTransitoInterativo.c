@@ -5,6 +5,8 @@
 #include "hardware/timer.h"
 #include "hardware/i2c.h"
 #include "ssd1306.h"
+#include "telemetria.h"
+#include "botoes.h"
 #include <string.h>
 
 // Definições dos pinos
@@ -14,6 +16,9 @@
 #define BOTAO_PEDESTRE_B 6
 #define BUZZER 21
 
+// Botões que solicitam travessia (outros pinos podem ser somados à máscara)
+#define BOTOES_PEDESTRE ((1u << BOTAO_PEDESTRE_A) | (1u << BOTAO_PEDESTRE_B))
+
 // Pinos I2C do OLED
 #define I2C_SDA 14
 #define I2C_SCL 15
@@ -23,6 +28,8 @@ struct render_area frame_area;
 
 volatile bool pedestre_acionou = false;
 
+botoes_t botoes;
+
 struct repeating_timer timer_botao;
 struct repeating_timer timer_semaforo;
 
@@ -76,12 +83,15 @@ int main() {
     frame_area.end_page = ssd1306_n_pages - 1;
     calculate_render_area_buffer_length(&frame_area);
 
-    add_repeating_timer_ms(100, callback_timer_botao, NULL, &timer_botao);
+    add_repeating_timer_ms(BOTOES_PERIODO_MS, callback_timer_botao, NULL, &timer_botao);
     iniciar_ciclo_semaforo();
 
     printf("Semaforo iniciado...\n");
 
+    telemetria_init();
+
     while (true) {
+        telemetria_tarefa(estado, contador);
         tight_loop_contents();
     }
 }
@@ -92,13 +102,7 @@ void inicializar_hardware() {
     gpio_init(LED_VERDE);
     gpio_set_dir(LED_VERDE, GPIO_OUT);
 
-    gpio_init(BOTAO_PEDESTRE_A);
-    gpio_set_dir(BOTAO_PEDESTRE_A, GPIO_IN);
-    gpio_pull_up(BOTAO_PEDESTRE_A);
-
-    gpio_init(BOTAO_PEDESTRE_B);
-    gpio_set_dir(BOTAO_PEDESTRE_B, GPIO_IN);
-    gpio_pull_up(BOTAO_PEDESTRE_B);
+    botoes_init(&botoes, BOTOES_PEDESTRE);
 
     gpio_init(BUZZER);
     gpio_set_dir(BUZZER, GPIO_OUT);
@@ -134,6 +138,7 @@ void iniciar_ciclo_semaforo() {
     gpio_put(LED_VERMELHO, 1);
     gpio_put(LED_VERDE, 0);
 
+    telemetria_reiniciar_callback();
     add_repeating_timer_ms(-1000, callback_timer_semaforo, NULL, &timer_semaforo);
 }
 
@@ -148,6 +153,7 @@ void iniciar_modo_travessia() {
 
     atualizar_display("AMARELO", contador);
 
+    telemetria_reiniciar_callback();
     add_repeating_timer_ms(-1000, callback_timer_semaforo, NULL, &timer_semaforo);
 }
 
@@ -161,33 +167,25 @@ void botao_pedestre() {
 }
 
 bool callback_timer_botao(struct repeating_timer *t) {
-    static bool aguardando_soltar = false;
-    static absolute_time_t ultimo_acionamento = {0};
-    const int DEBOUNCE_MS = 250;
-
-    bool pressionado = (!gpio_get(BOTAO_PEDESTRE_A) || !gpio_get(BOTAO_PEDESTRE_B));
-
-    if (pressionado) {
-        if (!aguardando_soltar) {
-            if (absolute_time_diff_us(ultimo_acionamento, get_absolute_time()) / 1000 > DEBOUNCE_MS) {
-                if (estado != ESPERANDO_TRAVESSIA && estado < TRAVESSIA_AMARELO) {
-                    estado = ESPERANDO_TRAVESSIA;
-                    contador = 2;
-                    cancel_repeating_timer(&timer_semaforo);
-                    add_repeating_timer_ms(-1000, callback_timer_semaforo, NULL, &timer_semaforo);
-                }
-                aguardando_soltar = true;
-                ultimo_acionamento = get_absolute_time();
-            }
+    botoes_varrer(&botoes);
+
+    if (botoes.pressionados) {
+        if (estado != ESPERANDO_TRAVESSIA && estado < TRAVESSIA_AMARELO) {
+            estado = ESPERANDO_TRAVESSIA;
+            contador = 2;
+            cancel_repeating_timer(&timer_semaforo);
+            telemetria_reiniciar_callback();
+            add_repeating_timer_ms(-1000, callback_timer_semaforo, NULL, &timer_semaforo);
+            telemetria_registrar_pedido();
         }
-    } else {
-        aguardando_soltar = false;
     }
 
     return true;
 }
 
 bool callback_timer_semaforo(struct repeating_timer *t) {
+    telemetria_registrar_callback(1000000);
+
     if (estado == ESPERANDO_TRAVESSIA) {
         botao_pedestre();
         if (contador == 0) {
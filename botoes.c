@@ -0,0 +1,22 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "botoes.h"
+
+// Configura todos os pinos da máscara como entrada com pull-up
+void botoes_init(botoes_t *b, uint32_t mascara) {
+    memset(b, 0, sizeof(*b));
+    b->mascara = mascara;
+
+    gpio_init_mask(mascara);
+    gpio_set_dir_in_masked(mascara);
+
+    for (uint32_t bits = mascara; bits; bits &= bits - 1) {
+        gpio_pull_up(__builtin_ctz(bits));
+    }
+}
+
+// Lê todos os botões de uma vez; deve ser chamada a cada BOTOES_PERIODO_MS
+void botoes_varrer(botoes_t *b) {
+    botoes_atualizar(b, gpio_get_all(), to_ms_since_boot(get_absolute_time()));
+}
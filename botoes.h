@@ -0,0 +1,59 @@
+#ifndef botoes_h
+#define botoes_h
+
+#include <stdint.h>
+
+// Varredura dos botões de pedestre com debounce paralelo por contador vertical.
+// Todos os pinos são lidos de uma vez (gpio_get_all) e cada bit da palavra é um botão;
+// os dois bits do contador de cada botão ficam "fatiados" em cnt0/cnt1, então o custo
+// da varredura é o mesmo para 2 ou 32 botões.
+//
+// A lógica abaixo não depende do SDK do Pico, para poder ser usada no benchmark do host
+// (tools/bench_botoes.c).
+
+#define BOTOES_MAX 32
+#define BOTOES_PERIODO_MS 10 // Um nível só é aceito após 4 varreduras iguais (~40 ms)
+
+typedef struct {
+    uint32_t mascara;       // Pinos monitorados
+    uint32_t estavel;       // Estado após o debounce (1 = pressionado)
+    uint32_t cnt0, cnt1;    // Contador vertical de 2 bits por botão
+    uint32_t pressionados;  // Bordas de pressão da última varredura
+    uint32_t soltos;        // Bordas de soltura da última varredura
+    uint32_t inicio_ms[BOTOES_MAX];  // Instante em que cada botão foi pressionado
+    uint32_t duracao_ms[BOTOES_MAX]; // Duração do último pressionamento concluído
+} botoes_t;
+
+// Processa uma amostra bruta dos pinos (nível baixo = pressionado, botões com pull-up)
+static inline void botoes_atualizar(botoes_t *b, uint32_t nivel, uint32_t agora_ms) {
+    uint32_t delta = (~nivel & b->mascara) ^ b->estavel;
+
+    // Conta amostras consecutivas diferentes do estado estável; zera quando voltam a coincidir
+    b->cnt1 = (b->cnt1 ^ b->cnt0) & delta;
+    b->cnt0 = ~b->cnt0 & delta;
+
+    uint32_t mudou = delta & ~(b->cnt0 | b->cnt1);
+    b->estavel ^= mudou;
+    b->pressionados = mudou & b->estavel;
+    b->soltos = mudou & ~b->estavel;
+
+    // Só percorre os bits que mudaram nesta varredura
+    for (uint32_t bits = b->pressionados; bits; bits &= bits - 1) {
+        b->inicio_ms[__builtin_ctz(bits)] = agora_ms;
+    }
+    for (uint32_t bits = b->soltos; bits; bits &= bits - 1) {
+        int i = __builtin_ctz(bits);
+        b->duracao_ms[i] = agora_ms - b->inicio_ms[i];
+    }
+}
+
+// Tempo em que o botão do pino está pressionado até agora (0 se estiver solto)
+static inline uint32_t botoes_tempo_pressionado(const botoes_t *b, int pino, uint32_t agora_ms) {
+    return (b->estavel >> pino) & 1u ? agora_ms - b->inicio_ms[pino] : 0;
+}
+
+// Funções do firmware
+void botoes_init(botoes_t *b, uint32_t mascara);
+void botoes_varrer(botoes_t *b);
+
+#endif
@@ -8,6 +8,23 @@
 #include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
 
+// Contadores de tráfego I2C (lidos pela telemetria)
+volatile uint32_t ssd1306_i2c_bytes_enviados = 0;
+volatile uint32_t ssd1306_i2c_erros = 0;
+
+// Escreve no barramento e contabiliza os bytes enviados ou a falha da transferência
+static int ssd1306_i2c_write(i2c_inst_t *i2c, uint8_t address, const uint8_t *src, size_t len) {
+    int resultado = i2c_write_blocking(i2c, address, src, len, false);
+
+    if (resultado < 0) {
+        ssd1306_i2c_erros++;
+    } else {
+        ssd1306_i2c_bytes_enviados += resultado;
+    }
+
+    return resultado;
+}
+
 // Calcular quanto do buffer será destinado à área de renderização
 void calculate_render_area_buffer_length(struct render_area *area) {
     area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
@@ -16,7 +33,7 @@ void calculate_render_area_buffer_length(struct render_area *area) {
 // Processo de escrita do i2c espera um byte de controle, seguido por dados
 void ssd1306_send_command(uint8_t command) {
     uint8_t buffer[2] = {0x80, command};
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, buffer, 2, false);
+    ssd1306_i2c_write(i2c1, ssd1306_i2c_address, buffer, 2);
 }
 
 // Envia uma lista de comandos ao hardware
@@ -33,7 +50,7 @@ void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
     temp_buffer[0] = 0x40;
     memcpy(temp_buffer + 1, ssd, buffer_length);
 
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
+    ssd1306_i2c_write(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1);
 
     free(temp_buffer);
 }
@@ -177,8 +194,8 @@ void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string) {
 // Comando de configuração com base na estrutura ssd1306_t
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-	ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false );
+  ssd1306_i2c_write(
+	ssd->i2c_port, ssd->address, ssd->port_buffer, 2);
 }
 
 // Função de configuração do display para o caso do bitmap
@@ -231,8 +248,8 @@ void ssd1306_send_data(ssd1306_t *ssd) {
     ssd1306_command(ssd, ssd1306_set_page_address);
     ssd1306_command(ssd, 0);
     ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(
-    ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false );
+    ssd1306_i2c_write(
+    ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize);
 }
 
 // Desenha o bitmap (a ser fornecido em display_oled.c) no display
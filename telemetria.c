@@ -0,0 +1,156 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#include "ssd1306.h"
+#include "telemetria.h"
+
+// Pacote em montagem e a última amostra gravada nele (referência para os deltas)
+static uint8_t pacote[TELEMETRIA_TAMANHO_PACOTE];
+static uint8_t amostras_no_pacote = 0;
+static uint8_t sequencia = 0;
+static telemetria_amostra_t ultima_amostra;
+static absolute_time_t proxima_amostra;
+
+// Atualizados a partir dos callbacks de timer
+static volatile uint16_t pedidos = 0;
+static volatile uint16_t jitter_us = 0;
+static uint64_t ultimo_callback_us = 0;
+static bool referencia_callback_valida = false;
+
+static void escrever_u16(uint8_t *destino, uint16_t valor) {
+    destino[0] = valor & 0xFF;
+    destino[1] = valor >> 8;
+}
+
+static void escrever_u32(uint8_t *destino, uint32_t valor) {
+    escrever_u16(destino, valor & 0xFFFF);
+    escrever_u16(destino + 2, valor >> 16);
+}
+
+void telemetria_init(void) {
+    amostras_no_pacote = 0;
+    proxima_amostra = make_timeout_time_ms(TELEMETRIA_PERIODO_MS);
+}
+
+// Chamada quando um pedido de travessia é aceito pelo semáforo
+void telemetria_registrar_pedido(void) {
+    pedidos++;
+}
+
+// Chamada no início do callback periódico; guarda o maior desvio em relação ao período esperado
+// até a próxima amostra
+void telemetria_registrar_callback(uint32_t periodo_us) {
+    uint64_t agora = time_us_64();
+
+    if (referencia_callback_valida) {
+        int64_t desvio = (int64_t)(agora - ultimo_callback_us) - periodo_us;
+        if (desvio < 0) {
+            desvio = -desvio;
+        }
+        if (desvio > UINT16_MAX) {
+            desvio = UINT16_MAX;
+        }
+        if (desvio > jitter_us) {
+            jitter_us = (uint16_t)desvio;
+        }
+    }
+
+    ultimo_callback_us = agora;
+    referencia_callback_valida = true;
+}
+
+// Chamada quando o timer é rearmado, para não contar o reinício como jitter
+void telemetria_reiniciar_callback(void) {
+    referencia_callback_valida = false;
+}
+
+// Fecha o pacote atual e o envia somente se houver espaço no FIFO da USB;
+// caso contrário o pacote é descartado para nunca bloquear o controle
+static void fechar_pacote(void) {
+    pacote[0] = TELEMETRIA_SYNC_0;
+    pacote[1] = TELEMETRIA_SYNC_1;
+    pacote[2] = sequencia++;
+    pacote[3] = amostras_no_pacote;
+
+    size_t usado = TELEMETRIA_OFFSET_DELTAS + (amostras_no_pacote - 1) * TELEMETRIA_TAMANHO_DELTA;
+    memset(pacote + usado, 0, TELEMETRIA_OFFSET_CRC - usado);
+    escrever_u16(pacote + TELEMETRIA_OFFSET_CRC, telemetria_crc16(pacote, TELEMETRIA_OFFSET_CRC));
+
+    if (stdio_usb_connected() && tud_cdc_write_available() >= TELEMETRIA_TAMANHO_PACOTE) {
+        stdio_usb.out_chars((const char *)pacote, TELEMETRIA_TAMANHO_PACOTE);
+    }
+
+    amostras_no_pacote = 0;
+}
+
+// Tenta gravar a amostra como delta; retorna false se algum campo não couber
+static bool gravar_delta(const telemetria_amostra_t *a) {
+    uint16_t d_pedidos = a->pedidos - ultima_amostra.pedidos;
+    uint32_t d_bytes = a->i2c_bytes - ultima_amostra.i2c_bytes;
+    uint16_t d_erros = a->i2c_erros - ultima_amostra.i2c_erros;
+
+    if (a->estado > 0x0F || a->contador > 0x0F || d_pedidos > UINT8_MAX ||
+        d_bytes > UINT16_MAX || d_erros > UINT8_MAX) {
+        return false;
+    }
+
+    uint8_t *p = pacote + TELEMETRIA_OFFSET_DELTAS + (amostras_no_pacote - 1) * TELEMETRIA_TAMANHO_DELTA;
+    p[0] = (a->estado << 4) | a->contador;
+    p[1] = d_pedidos;
+    escrever_u16(p + 2, d_bytes);
+    p[4] = d_erros;
+    escrever_u16(p + 5, a->jitter_us);
+    return true;
+}
+
+static void gravar_base(const telemetria_amostra_t *a, uint32_t t_ms) {
+    uint8_t *p = pacote + TELEMETRIA_OFFSET_BASE;
+
+    escrever_u32(pacote + TELEMETRIA_OFFSET_TEMPO, t_ms);
+    p[0] = a->estado;
+    p[1] = a->contador;
+    escrever_u16(p + 2, a->pedidos);
+    escrever_u32(p + 4, a->i2c_bytes);
+    escrever_u16(p + 8, a->i2c_erros);
+    escrever_u16(p + 10, a->jitter_us);
+}
+
+// Deve ser chamada no laço principal: coleta uma amostra a cada TELEMETRIA_PERIODO_MS
+void telemetria_tarefa(uint8_t estado, uint8_t contador) {
+    if (!time_reached(proxima_amostra)) {
+        return;
+    }
+    proxima_amostra = delayed_by_ms(proxima_amostra, TELEMETRIA_PERIODO_MS);
+
+    // Lê e zera o jitter sem que o callback do timer interfira
+    uint32_t interrupcoes = save_and_disable_interrupts();
+    uint16_t jitter_amostra = jitter_us;
+    jitter_us = 0;
+    restore_interrupts(interrupcoes);
+
+    telemetria_amostra_t a = {
+        .estado = estado,
+        .contador = contador,
+        .pedidos = pedidos,
+        .i2c_bytes = ssd1306_i2c_bytes_enviados,
+        .i2c_erros = (uint16_t)ssd1306_i2c_erros,
+        .jitter_us = jitter_amostra,
+    };
+
+    if (amostras_no_pacote > 0 && !gravar_delta(&a)) {
+        fechar_pacote();
+    }
+
+    if (amostras_no_pacote == 0) {
+        gravar_base(&a, to_ms_since_boot(get_absolute_time()));
+    }
+
+    ultima_amostra = a;
+    amostras_no_pacote++;
+
+    if (amostras_no_pacote == TELEMETRIA_AMOSTRAS_POR_PACOTE) {
+        fechar_pacote();
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef telemetria_h
+#define telemetria_h
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Protocolo da telemetria binária enviada pela USB CDC.
+// Este cabeçalho também é usado pelo decodificador do host (tools/telemetria_decoder.c),
+// por isso não depende do SDK do Pico.
+//
+// Pacote de tamanho fixo (little-endian):
+//   [0..1]   sincronismo 0xA5 0x5A
+//   [2]      número de sequência (lacunas indicam pacotes descartados)
+//   [3]      quantidade de amostras válidas no pacote
+//   [4..7]   instante da primeira amostra (ms desde o boot)
+//   [8..19]  primeira amostra com valores absolutos
+//   [20..61] demais amostras como deltas em relação à anterior
+//   [62..63] CRC-16/CCITT dos bytes 0..61
+//
+// Amostra absoluta: estado, contador, pedidos (u16), bytes I2C (u32), erros I2C (u16), jitter em us (u16)
+// Amostra delta: estado << 4 | contador, +pedidos (u8), +bytes I2C (u16), +erros I2C (u8), jitter em us (u16)
+//
+// pedidos: total de pedidos de travessia aceitos (os ignorados durante a travessia não contam)
+// jitter: maior desvio do timer de 1 s do semáforo desde a amostra anterior (0 se não houve tick)
+
+#define TELEMETRIA_PERIODO_MS 100
+#define TELEMETRIA_TAMANHO_PACOTE 64
+#define TELEMETRIA_SYNC_0 0xA5
+#define TELEMETRIA_SYNC_1 0x5A
+
+#define TELEMETRIA_OFFSET_TEMPO 4
+#define TELEMETRIA_OFFSET_BASE 8
+#define TELEMETRIA_TAMANHO_BASE 12
+#define TELEMETRIA_OFFSET_DELTAS (TELEMETRIA_OFFSET_BASE + TELEMETRIA_TAMANHO_BASE)
+#define TELEMETRIA_TAMANHO_DELTA 7
+#define TELEMETRIA_OFFSET_CRC (TELEMETRIA_TAMANHO_PACOTE - 2)
+#define TELEMETRIA_AMOSTRAS_POR_PACOTE \
+    (1 + (TELEMETRIA_OFFSET_CRC - TELEMETRIA_OFFSET_DELTAS) / TELEMETRIA_TAMANHO_DELTA)
+
+typedef struct {
+    uint8_t estado;
+    uint8_t contador;
+    uint16_t pedidos;
+    uint32_t i2c_bytes;
+    uint16_t i2c_erros;
+    uint16_t jitter_us;
+} telemetria_amostra_t;
+
+// CRC-16/CCITT (polinômio 0x1021, valor inicial 0xFFFF)
+static inline uint16_t telemetria_crc16(const uint8_t *dados, size_t tamanho) {
+    uint16_t crc = 0xFFFF;
+
+    for (size_t i = 0; i < tamanho; i++) {
+        crc ^= (uint16_t)dados[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+// Funções do firmware
+void telemetria_init(void);
+void telemetria_registrar_pedido(void);
+void telemetria_registrar_callback(uint32_t periodo_us);
+void telemetria_reiniciar_callback(void);
+void telemetria_tarefa(uint8_t estado, uint8_t contador);
+
+#endif
@@ -0,0 +1,128 @@
+// Benchmark (executa no computador) da varredura de botões:
+// debounce por pino, como o callback antigo, contra o contador vertical de botoes.h
+//
+// Compilação: cc -O2 -I. -o bench_botoes tools/bench_botoes.c
+// Uso: ./bench_botoes
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "botoes.h"
+
+#define AMOSTRAS 4096
+#define REPETICOES 2000
+#define DEBOUNCE_MS 250
+
+// Simula o registrador de entrada dos GPIOs
+static volatile uint32_t registrador_gpio;
+static uint32_t amostras[AMOSTRAS];
+
+// Equivalente ao gpio_get: uma leitura do registrador por pino
+static inline bool ler_pino(int pino) {
+    return (registrador_gpio >> pino) & 1u;
+}
+
+// Gera pressionamentos com trepidação: cada botão alterna entre solto e pressionado
+// e, nas primeiras amostras após cada troca, o nível oscila aleatoriamente
+static void gerar_amostras(int n_botoes) {
+    uint32_t semente = 12345;
+    uint32_t nivel = 0xFFFFFFFFu;
+    int trepidando[BOTOES_MAX] = {0};
+
+    for (int s = 0; s < AMOSTRAS; s++) {
+        uint32_t bruto = nivel;
+
+        for (int i = 0; i < n_botoes; i++) {
+            semente = semente * 1103515245u + 12345u;
+            if ((semente >> 16) % 200 == 0) {
+                nivel ^= 1u << i;
+                trepidando[i] = 3;
+            }
+            if (trepidando[i] > 0) {
+                trepidando[i]--;
+                if ((semente >> 8) & 1u) {
+                    bruto ^= 1u << i;
+                }
+            }
+        }
+
+        amostras[s] = bruto;
+    }
+}
+
+// Abordagem antiga: um gpio_get, um desvio e um instante de debounce por botão
+static uint32_t varrer_por_pino(int n_botoes) {
+    bool aguardando_soltar[BOTOES_MAX] = {false};
+    uint32_t ultimo_ms[BOTOES_MAX] = {0};
+    uint32_t bordas = 0;
+
+    for (int s = 0; s < AMOSTRAS; s++) {
+        registrador_gpio = amostras[s];
+        uint32_t agora_ms = (uint32_t)s * BOTOES_PERIODO_MS + DEBOUNCE_MS + 1;
+
+        for (int i = 0; i < n_botoes; i++) {
+            if (!ler_pino(i)) {
+                if (!aguardando_soltar[i] && agora_ms - ultimo_ms[i] > DEBOUNCE_MS) {
+                    aguardando_soltar[i] = true;
+                    ultimo_ms[i] = agora_ms;
+                    bordas++;
+                }
+            } else {
+                aguardando_soltar[i] = false;
+            }
+        }
+    }
+
+    return bordas;
+}
+
+// Abordagem nova: uma leitura de todos os pinos e o contador vertical
+static uint32_t varrer_vertical(int n_botoes) {
+    static botoes_t b;
+    uint32_t bordas = 0;
+
+    b = (botoes_t){0};
+    b.mascara = n_botoes == 32 ? 0xFFFFFFFFu : (1u << n_botoes) - 1;
+
+    for (int s = 0; s < AMOSTRAS; s++) {
+        registrador_gpio = amostras[s];
+        botoes_atualizar(&b, registrador_gpio, (uint32_t)s * BOTOES_PERIODO_MS);
+        bordas += __builtin_popcount(b.pressionados);
+    }
+
+    return bordas;
+}
+
+static double medir_ns(uint32_t (*varrer)(int), int n_botoes, uint32_t *bordas) {
+    struct timespec inicio, fim;
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    for (int r = 0; r < REPETICOES; r++) {
+        *bordas = varrer(n_botoes);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+    double ns = (fim.tv_sec - inicio.tv_sec) * 1e9 + (fim.tv_nsec - inicio.tv_nsec);
+    return ns / ((double)REPETICOES * AMOSTRAS);
+}
+
+int main(void) {
+    const int tamanhos[] = {2, 8, 16, 32};
+
+    printf("botoes  por_pino(ns/varredura)  vertical(ns/varredura)  bordas_por_pino  bordas_vertical\n");
+
+    for (size_t t = 0; t < sizeof(tamanhos) / sizeof(tamanhos[0]); t++) {
+        int n = tamanhos[t];
+        uint32_t bordas_pino, bordas_vertical;
+
+        gerar_amostras(n);
+        double ns_pino = medir_ns(varrer_por_pino, n, &bordas_pino);
+        double ns_vertical = medir_ns(varrer_vertical, n, &bordas_vertical);
+
+        printf("%6d  %22.2f  %22.2f  %15u  %15u\n",
+               n, ns_pino, ns_vertical, bordas_pino, bordas_vertical);
+    }
+
+    return 0;
+}
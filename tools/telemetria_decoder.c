@@ -0,0 +1,115 @@
+// Decodificador da telemetria binária do semáforo (executa no computador)
+//
+// Compilação: cc -O2 -I. -o telemetria_decoder tools/telemetria_decoder.c
+// Uso (Linux): stty -F /dev/ttyACM0 raw && ./telemetria_decoder /dev/ttyACM0 > telemetria.csv
+//
+// Lê o fluxo da USB CDC (ou de um arquivo), ressincroniza pelos bytes de sincronismo + CRC
+// e escreve uma linha CSV por amostra.
+
+#include <stdio.h>
+#include <string.h>
+#include "telemetria.h"
+
+static uint16_t ler_u16(const uint8_t *origem) {
+    return origem[0] | (origem[1] << 8);
+}
+
+static uint32_t ler_u32(const uint8_t *origem) {
+    return ler_u16(origem) | ((uint32_t)ler_u16(origem + 2) << 16);
+}
+
+static void imprimir_amostra(uint32_t t_ms, uint8_t seq, const telemetria_amostra_t *a) {
+    printf("%lu,%u,%u,%u,%u,%lu,%u,%u\n",
+           (unsigned long)t_ms, seq, a->estado, a->contador, a->pedidos,
+           (unsigned long)a->i2c_bytes, a->i2c_erros, a->jitter_us);
+}
+
+// Expande um pacote válido em amostras absolutas
+static void decodificar_pacote(const uint8_t *pacote) {
+    uint8_t seq = pacote[2];
+    uint8_t n = pacote[3];
+    uint32_t t_ms = ler_u32(pacote + TELEMETRIA_OFFSET_TEMPO);
+    const uint8_t *p = pacote + TELEMETRIA_OFFSET_BASE;
+
+    if (n == 0 || n > TELEMETRIA_AMOSTRAS_POR_PACOTE) {
+        return;
+    }
+
+    telemetria_amostra_t a = {
+        .estado = p[0],
+        .contador = p[1],
+        .pedidos = ler_u16(p + 2),
+        .i2c_bytes = ler_u32(p + 4),
+        .i2c_erros = ler_u16(p + 8),
+        .jitter_us = ler_u16(p + 10),
+    };
+    imprimir_amostra(t_ms, seq, &a);
+
+    for (int i = 1; i < n; i++) {
+        p = pacote + TELEMETRIA_OFFSET_DELTAS + (i - 1) * TELEMETRIA_TAMANHO_DELTA;
+        a.estado = p[0] >> 4;
+        a.contador = p[0] & 0x0F;
+        a.pedidos += p[1];
+        a.i2c_bytes += ler_u16(p + 2);
+        a.i2c_erros += p[4];
+        a.jitter_us = ler_u16(p + 5);
+        imprimir_amostra(t_ms + i * TELEMETRIA_PERIODO_MS, seq, &a);
+    }
+}
+
+int main(int argc, char **argv) {
+    FILE *entrada = stdin;
+
+    if (argc > 1) {
+        entrada = fopen(argv[1], "rb");
+        if (entrada == NULL) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    printf("t_ms,seq,estado,contador,pedidos,i2c_bytes,i2c_erros,jitter_us\n");
+
+    uint8_t janela[TELEMETRIA_TAMANHO_PACOTE];
+    size_t preenchido = 0;
+    int c;
+
+    while ((c = fgetc(entrada)) != EOF) {
+        janela[preenchido++] = (uint8_t)c;
+
+        // Descarta bytes até encontrar o início de um pacote
+        if (preenchido == 1 && janela[0] != TELEMETRIA_SYNC_0) {
+            preenchido = 0;
+            continue;
+        }
+        if (preenchido == 2 && janela[1] != TELEMETRIA_SYNC_1) {
+            preenchido = janela[1] == TELEMETRIA_SYNC_0 ? 1 : 0;
+            janela[0] = janela[1];
+            continue;
+        }
+        if (preenchido < TELEMETRIA_TAMANHO_PACOTE) {
+            continue;
+        }
+
+        if (ler_u16(janela + TELEMETRIA_OFFSET_CRC) == telemetria_crc16(janela, TELEMETRIA_OFFSET_CRC)) {
+            decodificar_pacote(janela);
+            preenchido = 0;
+            continue;
+        }
+
+        // CRC inválido: procura o próximo sincronismo dentro da janela
+        size_t inicio = 1;
+        while (inicio < preenchido && janela[inicio] != TELEMETRIA_SYNC_0) {
+            inicio++;
+        }
+        memmove(janela, janela + inicio, preenchido - inicio);
+        preenchido -= inicio;
+    }
+
+    if (entrada != stdin) {
+        fclose(entrada);
+    }
+
+    return 0;
+}